@@ -1,5 +1,7 @@
 #include "spotlight.h"
 
+#include <cmath>
+
 //==============================================================================
 namespace cg {
     //==============================================================================
@@ -31,12 +33,14 @@ namespace cg {
          distance to the light source (inverse square law).
          See also pointlight.cpp.
         */
-        const vec3 main_direction = this->m_direction; // Hauptrichtung des Lichts des Spotlights
-        const vec3 point_direction = normalize(light_direction_to(p)); // Richtung des Lichts zum Punkt
-        // falls Winkel zum Punkt > Öffnungswinkel der Lichtquelle → Punkt nicht im Lichtkegel
-        if (acos(dot(main_direction, point_direction)) > this->m_angle) return 0;
+        const vec3 point_direction = light_direction_to(p); // Richtung des Lichts zum Punkt (nicht normiert)
+        const double squared_distance = point_direction.squared_length();
+        // falls Winkel zum Punkt > Öffnungswinkel der Lichtquelle → Punkt nicht im Lichtkegel;
+        // acos ist monoton fallend, daher äquivalent zu cos(Winkel) < cos(Öffnungswinkel),
+        // mit |point_direction| multipliziert → kein acos und kein normalize nötig
+        if (dot(this->m_direction, point_direction) < std::cos(this->m_angle) * std::sqrt(squared_distance)) return 0;
         // Lichtintensität nimmt mit der Entfernung zur Lichtquelle quadratisch ab
-        return spectral_intensity() / light_direction_to(p).squared_length();
+        return spectral_intensity() / squared_distance;
     }
 
     //----------------------------------------------------------------------------
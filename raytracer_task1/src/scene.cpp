@@ -2,6 +2,8 @@
 
 #include <float.h>
 
+#include <algorithm>
+
 #include "directionallight.h"
 #include "light.h"
 #include "renderable.h"
@@ -9,11 +11,31 @@
 
 //==============================================================================
 namespace cg {
+    //==============================================================================
+    namespace {
+        /// makes room for n more elements in one allocation; grows at least
+        /// geometrically, so repeated inserts stay amortized O(1)
+        template<typename Container>
+        void reserve_additional(Container &c, std::size_t n) {
+            if (c.size() + n > c.capacity()) { c.reserve(std::max(c.size() + n, 2 * c.capacity())); }
+        }
+
+        /// reflection/refraction contributions weighted below this are not traced
+        constexpr double min_contribution_weight = 1e-3;
+
+        /// true if at least one color channel of weight is large enough to be visible
+        bool contributes(vec3 weight) {
+            return std::max({weight(0), weight(1), weight(2)}) >= min_contribution_weight;
+        }
+    } // namespace
+
     //==============================================================================
     Scene::Scene(const Scene &other) : m_background_color{other.m_background_color} {
+        m_renderables.reserve(other.m_renderables.size());
         for (const auto &renderable: other.m_renderables) {
             m_renderables.push_back(renderable->clone());
         }
+        m_light_sources.reserve(other.m_light_sources.size());
         for (const auto &light_source: other.m_light_sources) {
             m_light_sources.push_back(light_source->clone());
         }
@@ -21,12 +43,12 @@ namespace cg {
 
     //------------------------------------------------------------------------------
     Scene &Scene::operator=(const Scene &other) {
-        for (const auto &renderable: other.m_renderables) {
-            m_renderables.push_back(renderable->clone());
-        }
-        for (const auto &light_source: other.m_light_sources) {
-            m_light_sources.push_back(light_source->clone());
-        }
+        if (this == &other) { return *this; }
+        // copy into a temporary first, so the current contents are replaced (not
+        // appended to) and stay untouched if a clone throws
+        Scene copy{other};
+        m_renderables = std::move(copy.m_renderables);
+        m_light_sources = std::move(copy.m_light_sources);
         m_background_color = other.m_background_color;
         return *this;
     }
@@ -38,6 +60,7 @@ namespace cg {
 
     //------------------------------------------------------------------------------
     void Scene::insert(const AssembledRenderable &ar) {
+        reserve_additional(m_renderables, ar.renderables().size());
         for (const auto &r: ar.renderables()) {
             m_renderables.push_back(r->clone());
         }
@@ -45,6 +68,7 @@ namespace cg {
 
     //------------------------------------------------------------------------------
     void Scene::insert(AssembledRenderable &&ar) {
+        reserve_additional(m_renderables, ar.renderables().size());
         for (auto &r: ar.renderables()) { m_renderables.push_back(std::move(r)); }
     }
 
@@ -116,16 +140,23 @@ namespace cg {
         if (hit) {
             auto renderable = dynamic_cast<const Renderable *>(hit->intersectable);
             auto shaded_color = vec3::zeros();
+            // material constants are the same for every light source, so query
+            // them once per hit instead of once per light
+            const double reflectance = renderable->reflectance();
+            const double refractance = renderable->refractance();
+            // only a part of the total incoming light is used for shading the
+            // actual object. The rest is reflected or refracted. The fraction
+            // of light that is transported away is given by the reflectance
+            // and refractance constants of the material.
+            const double shading_fraction = 1 - reflectance - refractance;
+            const vec3 shadow_ray_origin = hit->position + 1e-6 * hit->normal;
             // first apply the lighting model for each light source
             for (const auto &light_source: lights()) {
-                if (!in_shadow(*light_source, hit->position + 1e-6 * hit->normal)) {
-                    shaded_color +=
-                            renderable->shade(*light_source, *hit) *
-                            (1 - renderable->reflectance() - renderable->refractance());
-                    // only a part of the total incoming light is used for shading the
-                    // actual object. The rest is reflected or refracted. The fraction
-                    // of light that is transported away is given by the reflectance
-                    // and refractance constants of the material.
+                // Licht erreicht den Punkt gar nicht (z.B. außerhalb des Spotlight-Kegels)
+                // → keinen Schattenstrahl verschießen
+                if (light_source->incident_radiance_at(hit->position).squared_length() == 0) { continue; }
+                if (!in_shadow(*light_source, shadow_ray_origin)) {
+                    shaded_color += renderable->shade(*light_source, *hit) * shading_fraction;
                 }
             }
 
@@ -137,14 +168,15 @@ namespace cg {
              this object.
              Remember that ray tracing is recursive.
             */
-            if (renderable->reflectance() > 0 &&
+            if (reflectance > 0 &&
                 incident_ray.num_reflections() < max_num_reflections) {
-                vec3 reflected_color = vec3::zeros();
+                const vec3 reflective_weight = renderable->sample_reflective_color(hit->uv) * reflectance;
+                // kaum sichtbarer Beitrag → Teilbaum der Rekursion gar nicht erst verfolgen
+                if (contributes(reflective_weight)) {
+                    vec3 reflected_color = vec3::zeros();
 
-                shaded_color +=
-                        reflected_color *
-                        renderable->sample_reflective_color(hit->uv) *
-                        renderable->reflectance();
+                    shaded_color += reflected_color * reflective_weight;
+                }
             }
 
             /*
@@ -153,14 +185,14 @@ namespace cg {
             ============================================================================
              Implement refraction analogously to reflection above.
             */
-            if (renderable->refractance() > 0 &&
+            if (refractance > 0 &&
                 incident_ray.num_reflections() < max_num_reflections) {
-                vec3 refracted_color = vec3::zeros();
+                const vec3 refractive_weight = renderable->sample_refractive_color(hit->uv) * refractance;
+                if (contributes(refractive_weight)) {
+                    vec3 refracted_color = vec3::zeros();
 
-                shaded_color +=
-                        refracted_color *
-                        renderable->sample_refractive_color(hit->uv) *
-                        renderable->refractance();
+                    shaded_color += refracted_color * refractive_weight;
+                }
             }
             return shaded_color;
         }
@@ -181,17 +213,11 @@ namespace cg {
          You can assume any object to be opaque for the shadow calculation (so even
          transparent objects cast a shadow).
         */
-        vec3 direction;
-        double max_t;
-
-        if (light_source.distance_to(position) == std::numeric_limits<double>::max()) { // gerichtetes Licht
-            direction = -light_source.light_direction_to(position); // '-' → Richtung von Punkt zu Licht
-            max_t = std::numeric_limits<double>::max(); // Licht "unendlich" weit entfernt
-        }
-        else { // Punktlicht
-            direction = -light_source.light_direction_to(position); // für + -> org: light_source.pos()
-            max_t = light_source.distance_to(position); // Distanz in beide Richtungen identisch
-        }
+        // '-' → Richtung von Punkt zu Licht (für + -> org: light_source.pos())
+        const vec3 direction = -light_source.light_direction_to(position);
+        // Distanz in beide Richtungen identisch; gerichtetes Licht liefert bereits
+        // std::numeric_limits<double>::max() ("unendlich" weit entfernt)
+        const double max_t = light_source.distance_to(position);
         // Bei Treffer liegt Objekt vor Lichtstrahl → Punkt im Schatten
         return any_intersection(Ray(position, direction), 0, max_t);
     }